@@ -59,8 +59,16 @@
 #define XtCOpenSelection         "OpenSelection"
 #define XtNtrace                 "trace"
 #define XtCTrace                 "Trace"
+#define XtNtiming                "timing"
+#define XtCTiming                "Timing"
+#define XtNlogFormat             "logFormat"
+#define XtCLogFormat             "LogFormat"
+#define XtNmaxLogSize            "maxLogSize"
+#define XtCMaxLogSize            "MaxLogSize"
 #define XtNplayLog               "playLog"
 #define XtCPlayLog               "PlayLog"
+#define XtNplayLogMode           "playLogMode"
+#define XtCPlayLogMode           "PlayLogMode"
 #define XtNrestartCommands       "restartCommands"
 #define XtCInitCommands          "InitCommands"
 #define XtNsourceInitCommands    "sourceInitCommands"
@@ -101,6 +109,12 @@
 #define XtCIndent                "Indent"
 #define XtNlineBufferedConsole   "lineBufferredConsole"
 #define XtCLineBuffered          "LineBuffered"
+#define XtNmaxConsoleLines       "maxConsoleLines"
+#define XtCMaxConsoleLines       "MaxConsoleLines"
+#define XtNmaxConsoleLength      "maxConsoleLength"
+#define XtCMaxConsoleLength      "MaxConsoleLength"
+#define XtNsaveConsoleOverflow   "saveConsoleOverflow"
+#define XtCSaveConsoleOverflow   "SaveConsoleOverflow"
 #define XtNconsoleHasFocus       "consoleHasFocus"
 #define XtCConsoleHasFocus       "ConsoleHasFocus"
 #define XtNbashDisplayShortcuts  "bashDisplayShortcuts"
@@ -256,6 +270,10 @@
 #define XtCBlockTTYInput         "BlockTTYInput"
 #define XtNbufferGDBOutput       "bufferGDBOutput"
 #define XtCBufferGDBOutput       "BufferGDBOutput"
+#define XtNuseGDBMI             "useGDBMI"
+#define XtCUseGDBMI             "UseGDBMI"
+#define XtNpipelineQuestions    "pipelineQuestions"
+#define XtCPipelineQuestions    "PipelineQuestions"
 #define XtNdisplayGlyphs         "displayGlyphs"
 #define XtCDisplayGlyphs         "DisplayGlyphs"
 #define XtNmaxGlyphs             "maxGlyphs"
@@ -325,6 +343,14 @@
 #define XtCShowMemberNames       "ShowMemberNames"
 #define XtNexpandRepeatedValues  "expandRepeatedValues"
 #define XtCExpandRepeatedValues  "ExpandRepeatedValues"
+#define XtNarrayWindowSize       "arrayWindowSize"
+#define XtCArrayWindowSize       "ArrayWindowSize"
+#define XtNbinaryArrayThreshold  "binaryArrayThreshold"
+#define XtCBinaryArrayThreshold  "BinaryArrayThreshold"
+#define XtNdisplayTimeSlice      "displayTimeSlice"
+#define XtCDisplayTimeSlice      "DisplayTimeSlice"
+#define XtNparseThreads          "parseThreads"
+#define XtCParseThreads          "ParseThreads"
 #define XtNbumpDisplays          "bumpDisplays"
 #define XtCBumpDisplays          "BumpDisplays"
 #define XtNhideInactiveDisplays  "hideInactiveDisplays"
@@ -410,7 +436,11 @@ struct AppData {
     Boolean   auto_debugger;
     Boolean   open_selection;
     Boolean   trace;
+    Boolean   timing;
+    const _XtString    log_format;
+    int       max_log_size;
     const _XtString    play_log;
+    const _XtString    play_log_mode;
     const _XtString    restart_commands;
     Boolean   source_init_commands;
     const _XtString    init_symbols;
@@ -434,6 +464,9 @@ struct AppData {
     Cardinal  indent_script;
     Cardinal  indent_code;
     Boolean   line_buffered_console;
+    int       max_console_lines;
+    int       max_console_length;
+    Boolean   save_console_overflow;
     OnOff     console_has_focus;
     const _XtString    bash_display_shortcuts;
     const _XtString    dbg_display_shortcuts;
@@ -517,6 +550,8 @@ struct AppData {
     Boolean   tty_mode;
     OnOff     block_tty_input;
     OnOff     buffer_gdb_output;
+    Boolean   use_gdb_mi;
+    Boolean   pipeline_questions;
     Cardinal  annotate;
     Boolean   display_glyphs;
     Cardinal  max_glyphs;
@@ -558,6 +593,10 @@ struct AppData {
     unsigned char struct_orientation;
     Boolean   show_member_names;
     Boolean   expand_repeated_values;
+    int       array_window_size;
+    int       binary_array_threshold;
+    int       display_time_slice;
+    int       parse_threads;
     Boolean   bump_displays;
     Boolean   hide_inactive_displays;
     Boolean   show_base_display_titles;
@@ -198,6 +198,9 @@ extern Widget find_shell(Widget w = 0);
 // Process next element from command queue
 extern void processCommandQueue(XtPointer = 0, XtIntervalId *id = 0);
 
+// GDB is ready again; check whether the current stop is done
+extern void check_stop_timing();
+
 // True if GDB processed any user command (= we had user interaction)
 extern bool userInteractionSeen();
 
@@ -153,6 +153,39 @@ class DataDisp {
     static XtIntervalId refresh_graph_edit_timer;
     static XtIntervalId refresh_addr_timer;
 
+    //-----------------------------------------------------------------------
+    // Background display updates
+    //-----------------------------------------------------------------------
+    static Boolean UpdateDisplaysWorkProc(XtPointer client_data);
+
+    // Time until which display values may be parsed now
+    static double update_deadline();
+
+    // Update DN from VALUE, appending remaining output to REST;
+    // return true if DN changed.  SOURCE is passed to
+    // DispNode::update().
+    static bool update_display(DispNode *dn, string& value, string& rest,
+			       DispValue *source = 0);
+
+    // Forget display values not yet processed
+    static void cancel_pending_updates();
+
+    // A display not yet updated
+    struct PendingUpdate {
+	int disp_nr;		// Display number
+	string value;		// New value
+	int parse_job;		// Job parsing VALUE in a worker, or -1
+
+	PendingUpdate(int nr, const string& v, int job = -1)
+	    : disp_nr(nr), value(v), parse_job(job)
+	{}
+    };
+
+    // Displays not yet updated and the next one
+    static std::vector<PendingUpdate> pending_updates;
+    static int next_pending_update;
+    static XtWorkProcId update_displays_proc;
+
     //-----------------------------------------------------------------------
     // Sorting nodes for layout
     //-----------------------------------------------------------------------
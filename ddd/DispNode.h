@@ -178,8 +178,10 @@ public:
 
 
 
-    // Update with NEW_VALUE; return false if value is unchanged
-    bool update (string& new_value);
+    // Update with NEW_VALUE; return false if value is unchanged.  If
+    // SOURCE is given, it is NEW_VALUE as parsed by
+    // DispValue::parse_in_thread().
+    bool update (string& new_value, DispValue *source = 0);
 
     // Update address with NEW_ADDR
     void set_addr(const string& new_addr);
@@ -36,12 +36,15 @@
 #include "base/bool.h"
 #include "base/mutable.h"
 #include "DispValueT.h"
+#include "DispValueC.h"
 #include "template/StringSA.h"
 #include "box/Box.h"
 #include <Xm/Xm.h>
 
 #include <vector>
 #include <map>
+#include <atomic>
+#include <string.h>
 
 
 class Agent;
@@ -51,35 +54,41 @@ typedef unsigned char DispValueOrientation;
 const unsigned char Vertical   = XmVERTICAL;
 const unsigned char Horizontal = XmHORIZONTAL;
 
+// Members are ordered by size, such that there is no padding
 class DispValue {
     // General members
-    DispValueType m_type;
-    bool m_expanded;
-    bool m_enabled;
-    string m_full_name;		// Full name
-    string m_print_name;	// Name relative to parent
+    DispValueName m_name;	// Full name and name relative to parent
     string m_addr;		// Address as found
-    bool m_changed;
-    int m_repeats;		// Number of repetitions
 
     // Type-dependent members
-    string m_value;		// Value of basic types
-    bool m_dereferenced;	// True iff pointer is dereferenced
-    bool m_member_names;	// True iff struct shows member names
-    std::vector<DispValue *> m_children;	// Array or Struct members
-    int m_index_base;		// First index
-    bool m_have_index_base;	// True if INDEX_BASE is valid
-    mutable DispValueOrientation m_orientation; // Array orientation
-    mutable bool m_has_plot_orientation;   // True if plotter set the orientation
+    DispValueString m_value;	// Value of basic types
+    DispValueArray m_children;	// Array or Struct members
 
     // Plotting stuff
     mutable PlotAgent *m_plotter;	// Plotting agent
 
     // Caching stuff
     Box *m_cached_box;		    // Last box
-    int m_cached_box_change;        // Last cached box change
     static int m_cached_box_tics;   // Counter
 
+    // Incremental update
+    unsigned long long m_text_hash; // Hash of text parsed (in context)
+    int m_text_length;		    // Length of text parsed; -1 if unknown
+
+    int m_cached_box_change;        // Last cached box change
+    int m_repeats;		// Number of repetitions
+    int m_index_base;		// First index
+    DispValueType m_type;
+
+    bool m_expanded;
+    bool m_enabled;
+    bool m_changed;
+    bool m_dereferenced;	// True iff pointer is dereferenced
+    bool m_member_names;	// True iff struct shows member names
+    bool m_have_index_base;	// True if INDEX_BASE is valid
+    mutable bool m_has_plot_orientation;   // True if plotter set the orientation
+    mutable DispValueOrientation m_orientation; // Array orientation
+
     // Initialize from VALUE.  If TYPE is given, use TYPE as type
     // instead of inferring it.
     void init(DispValue *parent, int depth, 
@@ -96,6 +105,14 @@ class DispValue {
     static int index_base(const string& expr, int dim);
     static string add_member_name(const string& base, 
 				  const string& member_name);
+    static DispNameBase *element_names(const string& base);
+    static DispValueName element_name(DispNameBase *elements, int index);
+
+    // Array windows
+    string window_expr(const string& base, int from) const;
+    DispValue *window_placeholder(int depth, const string& base, int from);
+    bool read_binary_elements(int depth, DispNameBase *names, 
+			      string& value);
 
     // Plotting stuff
     bool getGnuplotType(string expr, string &gdbtype, string &gnuplottype, string &sizestr) const;
@@ -120,12 +137,28 @@ class DispValue {
     DispValue *_update(DispValue *source, 
 		       bool& was_changed, bool& was_initialized);
 
+    // Subtrees whose text did not change are reused when updating
+    static unsigned long long text_hash(const char *text, int length,
+					int available, const DispValue *parent,
+					int depth, DispValueType type);
+    static DispValue *reuse(DispValue *parent, int depth, string& value,
+			    const DispValueName& name, DispValueType type);
+    void make_reusable();
+    bool clear_changed();
+    DispValue *parse_update(string& value, bool& was_changed,
+			    DispValueType type = UnknownType);
+
+    // Worker threads
+    static void release_box(Box *box);
+    static bool may_ask_gdb();
+    static bool in_background(int processed);
+
     // Clear cached box
     void clear_cached_box()
     {
 	if (m_cached_box != 0)
 	{
-            m_cached_box->unlink();
+            release_box(m_cached_box);
             m_cached_box = 0;
 	}
         m_cached_box_change = 0;
@@ -144,6 +177,17 @@ private:
 protected:
     int m_links;			// #references (>= 1)
 
+    // Rename a copy
+    void rename(const DispValueName& name);
+    void rename_descendants(const string& old_name, const string& new_name);
+
+    // Set full name to FULL_NAME
+    void set_full_name(const string& full_name)
+    {
+	clear_cached_box();
+	m_name = DispValueName(full_name, name());
+    }
+
     // Array, Struct
     // Expand/collapse single value
     void _expand()
@@ -174,25 +218,32 @@ protected:
     DispValue (DispValue *parent, 
 	       int        depth,
 	       string&    value,
-	       const string& full_name, 
-	       const string& print_name,
+	       const DispValueName& name,
 	       DispValueType type = UnknownType);
 
     // Parsing function
     static DispValue *parse(DispValue *parent, 
 			    int depth,
 			    string& value,
-			    const string& full_name, 
-			    const string& print_name,
+			    const DispValueName& name,
 			    DispValueType type = UnknownType);
 
+    DispValue *parse_child(int depth,
+			   string& value,
+			   const DispValueName& name,
+			   DispValueType type = UnknownType)
+    {
+	return parse(this, depth + 1, value, name, type);
+    }
+
     DispValue *parse_child(int depth,
 			   string& value,
 			   const string& full_name, 
 			   const string& _print_name,
 			   DispValueType type = UnknownType)
     {
-	return parse(this, depth + 1, value, full_name, _print_name, type);
+	return parse_child(depth, value, 
+			   DispValueName(full_name, _print_name), type);
     }
 
     DispValue *parse_child(int depth,
@@ -217,7 +268,7 @@ public:
     // Parse VALUE into a DispValue tree
     static DispValue *parse(string& value, const string& name)
     {
-	return parse(0, 0, value, name, name);
+	return parse(0, 0, value, DispValueName(name, name));
     }
 
     // Duplicator
@@ -252,15 +303,13 @@ public:
     // General resources
     DispValueType type()       const { return m_type; }
     bool enabled()             const { return m_enabled; }
-    const string& full_name()  const { return m_full_name; }
-    const string& name()       const { return m_print_name; }
+    string full_name()         const { return m_name.full_name(); }
+    string name()              const { return m_name.name(); }
     const string& addr()       const { return m_addr; }
     int repeats()              const { return m_repeats; }
     bool has_plot_orientation()  const { return m_has_plot_orientation; }
 
     int& repeats()       { clear_cached_box(); return m_repeats; }
-    string& full_name()  { clear_cached_box(); return m_full_name; }
-    string& name()       { clear_cached_box(); return m_print_name; }
     bool& enabled()      { clear_cached_box(); return m_enabled; }
 
     bool is_changed() const { return m_changed; }
@@ -278,7 +327,15 @@ public:
     // Type-specific resources
 
     // Simple or Pointer
-    const string& value() const { return m_value; }
+    string value() const { return m_value.str(); }
+
+    // Array member standing for the elements not read; its full
+    // name is an expression for the next window of elements
+    bool is_placeholder() const
+    {
+	return m_type == Simple && m_value.length() == 3 &&
+	    strcmp(m_value.chars(), "...") == 0;
+    }
 
     // Pointer
     bool dereferenced() const { return m_dereferenced; }
@@ -341,6 +398,24 @@ public:
     DispValue *update(DispValue *source, 
 		      bool& was_changed, bool& was_initialized);
 
+    // Parse VALUE as a new value named NAME.  This may run in a
+    // worker thread while the main thread goes on; it shares no
+    // values with other threads.  Boxes to be released are added to
+    // BOXES.  Parsing stops as soon as CANCELLED is set.  Return 0 if
+    // GDB must be asked for parsing; in this case, VALUE is unchanged
+    // and must be parsed in the main thread.
+    static DispValue *parse_in_thread(string& value, const string& name,
+				      std::vector<Box *>& boxes,
+				      const std::atomic<bool>& cancelled);
+
+    // Update values from SOURCE, as parsed from VALUE by
+    // parse_in_thread().  Set WAS_CHANGED iff value changed; Set
+    // WAS_INITIALIZED iff type changed.  Note: Neither THIS nor
+    // SOURCE can be referenced after calling this function; use the
+    // returned value instead.
+    DispValue *update(DispValue *source, string& value,
+		      bool& was_changed, bool& was_initialized);
+
     // Return true iff SOURCE and this are structurally equal.
     // If SOURCE_DESCENDANT (a descendant of SOURCE) is not 0,
     // return its equivalent descendant of this in DESCENDANT.
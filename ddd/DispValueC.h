@@ -0,0 +1,335 @@
+// $Id$ -*- C++ -*-
+// Compact storage for display values
+
+// Copyright (c) 2025  Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_DispValueC_h
+#define _DDD_DispValueC_h
+
+// A display may have millions of values.  The classes below keep
+// the per-value overhead small.
+
+#include "base/strclass.h"
+#include "base/bool.h"
+#include "base/assert.h"
+
+#include <atomic>
+#include <vector>
+
+class DispValue;
+
+
+//-----------------------------------------------------------------------------
+// Names
+//-----------------------------------------------------------------------------
+
+// How full names are derived from a DispNameBase
+enum DispNameKind {
+    ExplicitName,		// Full name is PREFIX
+    MemberName,			// Full name is PREFIX + NAME + SUFFIX
+    ElementName			// Name of element I is
+				// INDEX_PREFIX + I + INDEX_SUFFIX;
+				// full name is PREFIX + NAME
+};
+
+// The parts of full names shared by the members of an array or a
+// struct.  Member names are kept here, too, such that they go away
+// with the struct.  Values from different threads may share a base;
+// hence, the reference counter is atomic.  Names are only added
+// while parsing, by the parsing thread.
+class DispNameBase {
+    std::atomic<int> m_links;	// #references (>= 1)
+    DispNameKind m_kind;
+    string m_prefix;
+    string m_suffix;
+    string m_index_prefix;
+    string m_index_suffix;
+    std::vector<string> m_names; // Names (ExplicitName, MemberName)
+
+    DispNameBase(const DispNameBase&);
+    DispNameBase& operator = (const DispNameBase&);
+
+public:
+    DispNameBase(DispNameKind kind, const string& prefix,
+		 const string& suffix = "",
+		 const string& index_prefix = "",
+		 const string& index_suffix = "")
+	: m_links(1), m_kind(kind), m_prefix(prefix), m_suffix(suffix),
+	  m_index_prefix(index_prefix), m_index_suffix(index_suffix),
+	  m_names()
+    {}
+
+    DispNameKind kind()          const { return m_kind; }
+    const string& prefix()       const { return m_prefix; }
+    const string& suffix()       const { return m_suffix; }
+    const string& index_prefix() const { return m_index_prefix; }
+    const string& index_suffix() const { return m_index_suffix; }
+
+    // Name number I
+    const string& name(int i) const
+    {
+	assert(i >= 0 && i < int(m_names.size()));
+	return m_names[i];
+    }
+
+    // Add NAME; return its number
+    int add_name(const string& name);
+
+    // Create new reference
+    DispNameBase *link()
+    {
+	assert(m_links > 0);
+	m_links++;
+	return this;
+    }
+
+    // Kill reference
+    void unlink()
+    {
+	assert(m_links > 0);
+	if (--m_links == 0)
+	    delete this;
+    }
+};
+
+// The full name of a value and its name relative to the parent.
+// Member names are numbered in the base; array element names are
+// derived from the index.
+class DispValueName {
+    DispNameBase *m_base;	// Shared parts
+    int m_index;		// Name number (ExplicitName, MemberName)
+				// or index (ElementName)
+
+    // The full name is the concatenation of up to four parts.
+    // BUFFER holds the digits of an element index.
+    enum { MAX_PARTS = 4 };
+    int parts(const char *chars[], int lengths[], char *buffer) const;
+
+public:
+    // Value named NAME whose full name is FULL_NAME
+    DispValueName(const string& full_name, const string& name);
+
+    // Member NAME of BASE
+    DispValueName(DispNameBase *base, const string& name)
+	: m_base(base->link()), m_index(0)
+    {
+	assert(base->kind() != ElementName);
+	m_index = base->add_name(name);
+    }
+
+    // Element INDEX of BASE
+    DispValueName(DispNameBase *base, int index)
+	: m_base(base->link()), m_index(index)
+    {
+	assert(base->kind() == ElementName);
+    }
+
+    DispValueName(const DispValueName& n)
+	: m_base(n.m_base->link()), m_index(n.m_index)
+    {}
+
+    DispValueName& operator = (const DispValueName& n)
+    {
+	if (this != &n)
+	{
+	    DispNameBase *base = n.m_base->link();
+	    m_base->unlink();
+	    m_base  = base;
+	    m_index = n.m_index;
+	}
+	return *this;
+    }
+
+    ~DispValueName()
+    {
+	m_base->unlink();
+    }
+
+    // The full name
+    string full_name() const;
+
+    // The name relative to the parent
+    string name() const;
+
+    // Hash value of the full name
+    unsigned long long hash() const;
+
+    // Compare full names, without building them
+    bool operator == (const DispValueName& n) const;
+    bool operator != (const DispValueName& n) const
+    {
+	return !operator == (n);
+    }
+};
+
+
+//-----------------------------------------------------------------------------
+// Children
+//-----------------------------------------------------------------------------
+
+// The members of an array or struct.  A single member is stored
+// inline; for more members, the capacity is the next power of two.
+class DispValueArray {
+    union {
+	DispValue *m_single;	// The member (if size == 1)
+	DispValue **m_values;	// The members (if size > 1)
+    };
+    int m_size;
+
+    DispValueArray(const DispValueArray&);
+    DispValueArray& operator = (const DispValueArray&);
+
+public:
+    DispValueArray()
+	: m_single(0), m_size(0)
+    {}
+
+    ~DispValueArray()
+    {
+	clear();
+    }
+
+    int size() const { return m_size; }
+
+    DispValue **begin()
+    {
+	return m_size > 1 ? m_values : &m_single;
+    }
+    DispValue *const *begin() const
+    {
+	return m_size > 1 ? m_values : &m_single;
+    }
+    DispValue **end()             { return begin() + m_size; }
+    DispValue *const *end() const { return begin() + m_size; }
+
+    DispValue*& operator[](int i)
+    {
+	assert(i >= 0 && i < m_size);
+	return begin()[i];
+    }
+    DispValue *operator[](int i) const
+    {
+	assert(i >= 0 && i < m_size);
+	return begin()[i];
+    }
+
+    // Append DV
+    void push_back(DispValue *dv);
+
+    // Remove all members (without unlinking them)
+    void clear();
+};
+
+
+//-----------------------------------------------------------------------------
+// Strings
+//-----------------------------------------------------------------------------
+
+// A string value.  Values of up to INLINE_LENGTH characters (most
+// numbers, pointers, and characters) are stored inline.
+class DispValueString {
+    enum { INLINE_LENGTH = 15 };
+
+    // The last byte holds INLINE_LENGTH - length for inline values
+    // (such that it doubles as terminator of a full-length value)
+    // and HEAP for values on the heap.
+    enum { HEAP = 0xff };
+
+    union {
+	char m_chars[INLINE_LENGTH + 1];
+	string *m_string;
+    };
+
+    bool on_heap() const
+    {
+	return (unsigned char)m_chars[INLINE_LENGTH] == HEAP;
+    }
+
+    void set(const char *s, int length);
+    void free()
+    {
+	if (on_heap())
+	    delete m_string;
+    }
+
+public:
+    DispValueString()
+    {
+	set("", 0);
+    }
+
+    DispValueString(const DispValueString& s)
+    {
+	set(s.chars(), s.length());
+    }
+
+    DispValueString& operator = (const DispValueString& s)
+    {
+	if (this != &s)
+	{
+	    free();
+	    set(s.chars(), s.length());
+	}
+	return *this;
+    }
+
+    DispValueString& operator = (const string& s)
+    {
+	free();
+	set(s.chars(), s.length());
+	return *this;
+    }
+
+    ~DispValueString()
+    {
+	free();
+    }
+
+    int length() const
+    {
+	if (on_heap())
+	    return m_string->length();
+	return INLINE_LENGTH - m_chars[INLINE_LENGTH];
+    }
+
+    const char *chars() const
+    {
+	if (on_heap())
+	    return m_string->chars();
+	return m_chars;
+    }
+
+    bool empty() const { return length() == 0; }
+
+    string str() const { return string(chars(), length()); }
+
+    bool operator == (const DispValueString& s) const;
+    bool operator != (const DispValueString& s) const
+    {
+	return !operator == (s);
+    }
+};
+
+#endif // _DDD_DispValueC_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -48,6 +48,7 @@
 #include "base/bool.h"
 #include "base/assert.h"
 #include "template/VoidArray.h"
+#include "timing.h"
 
 #include <vector>
 
@@ -207,6 +208,7 @@ protected:
     bool _detect_echos;		// True if echos are to be detected
     bool _buffer_gdb_output;	// True if GDB output is to be buffered
     bool _flush_next_output;	// True if next GDB output is to be flushed
+    bool _pipeline_questions;	// True if question arrays may be pipelined
 
     string last_prompt;		// Last prompt received
     string last_written;	// Last command sent
@@ -229,6 +231,9 @@ protected:
     // General trace function
     void trace(const char *prefix, void *call_data) const;
 
+    // Trace read statistics
+    void trace_read_stats() const;
+
     // Perl specials
     static void munch_perl_array(string& value, bool hash);
     static void munch_perl_scalar(string& value);
@@ -246,10 +251,12 @@ public:
 
     ~GDBAgent ();
 
+    // If USE_MI is set, talk to GDB via its machine interface
     static
     GDBAgent* Create (XtAppContext app_context,
 	      const string& gdb_call,
-	      DebuggerType type);
+	      DebuggerType type,
+	      bool use_mi = false);
 
     // Start new process
     void do_start (OAProc  on_answer,
@@ -742,6 +749,13 @@ public:
     bool flush_next_output() const       { return _flush_next_output; }
     bool flush_next_output(bool val)     { return _flush_next_output = val; }
 
+    // True if question arrays are sent all at once
+    bool pipeline_questions() const      { return _pipeline_questions; }
+    bool pipeline_questions(bool val)    { return _pipeline_questions = val; }
+
+    // Number of round trips saved by pipelining so far
+    int round_trips_saved() const        { return _round_trips_saved; }
+
     // Place quotes around filename FILE if needed
     string quote_file(const string& file) const;
 
@@ -773,6 +787,11 @@ public:
     virtual string frame_command() const;	    // frame
     virtual string func_command() const { return frame_command(); }
     virtual string echo_command(const string& text) const;
+
+    // Command to output MARKER, separating pipelined answers;
+    // "" if pipelining is not supported
+    virtual string sync_command(const string& marker) const
+	{ /*UNUSED*/ (void (marker)); return ""; }
     virtual string whatis_command(const string& expr) const
 	{ /*UNUSED*/ (void (expr)); return ""; }
     string dereferenced_expr(const string& expr) const;    // *EXPR
@@ -854,8 +873,19 @@ public:
     // Write a command (not debuggee interaction or control characters)
     virtual int write_cmd(const string& cmd) { return write(cmd); }
 
+    // Translate raw debugger output ANSWER before processing it
+    virtual void filter_input(string& answer) { /* UNUSED */ (void (answer)); }
+
     // True if ANSWER ends in a prompt
     virtual bool ends_with_prompt(const string& answer);
+
+    // Same, but only examine the last lines of ANSWER.  Use this for
+    // answers that are assembled incrementally.
+    bool answer_ends_with_prompt(const string& answer);
+
+    // True if prompts can only be recognized by examining the whole
+    // answer, rather than its last lines (which may start mid-line)
+    virtual bool prompt_needs_whole_answer() const { return false; }
     virtual bool ends_with_secondary_prompt(const string& answer) const
     { 
 	/* Unused */ (void (answer));
@@ -942,6 +972,16 @@ private:
     VoidArray _qu_datas;
     void*   _qa_data;
 
+    bool    qu_pipelined;	// True if current question array is pipelined
+    int     qu_serial;		// Serial number of current question array
+    int     qu_sent;		// Number of pipelined questions sent
+    int     qu_windows;		// Number of pipelined writes
+    string  qu_pipe_answer;	// Unprocessed pipelined output
+    int     qu_pipe_scanned;	// Marker is not before this position
+    int     _round_trips_saved;
+
+    CommandTimer cmd_timer;	// Timestamps of current command
+
     OAProc   _on_answer;
     OACProc  _on_answer_completion;
     OQACProc _on_qu_array_completion;
@@ -952,6 +992,13 @@ private:
 			   OQACProc on_qu_array_completion,
 			   void*    qa_data);
 
+    void    send_questions();
+    void    send_question_window();
+    string  sync_marker(int index) const;
+    void    handle_pipelined_input(const string& answer);
+    void    answer_complete(string& answer);
+    void    qu_array_complete();
+
     string requires_reply(const string& answer);
 
     void strip_dbx_comments(string& answer) const;
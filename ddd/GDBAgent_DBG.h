@@ -33,6 +33,7 @@ public:
     GDBAgent_DBG (XtAppContext app_context,
 	      const string& gdb_call);
     bool ends_with_prompt (const string& ans) override;
+    bool prompt_needs_whole_answer() const override { return true; }
     void cut_off_prompt(string& answer) const override;
     string print_command(const char *expr, bool internal=true) const override;
     string info_locals_command() const override;
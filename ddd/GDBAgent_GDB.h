@@ -25,6 +25,11 @@
 // `http://www.gnu.org/software/ddd/',
 // or send a mail to the DDD developers <ddd@gnu.org>.
 
+#ifndef _DDD_GDBAgent_GDB_h
+#define _DDD_GDBAgent_GDB_h
+
+#include "GDBAgent.h"
+
 extern char *GDBAgent_GDB_init_commands;
 extern char *GDBAgent_GDB_settings;
 
@@ -32,7 +37,8 @@ class GDBAgent_GDB: public GDBAgent {
 public:
     // Constructor
     GDBAgent_GDB (XtAppContext app_context,
-	      const string& gdb_call);
+	      const string& gdb_call,
+	      unsigned nTypes = GDBAgent_NTypes);
     bool ends_with_prompt (const string& ans) override;
     bool ends_with_secondary_prompt(const string& answer) const override;
     void cut_off_prompt(string& answer) const override;
@@ -41,6 +47,7 @@ public:
     string info_display_command() const override { return "info display"; }
     string make_command(const string& target) const override;
     string jump_command(const string& pc) const override { return "jump " + pc; }
+    string sync_command(const string& marker) const override { return echo_command(marker); }
     string regs_command(bool all = true) const override;
     string watch_command(const string&, WatchMode) const override;
     string whatis_command(const string& expr) const override
@@ -72,3 +79,5 @@ public:
                                      string pos, string num, string cond,
                                      bool as_dummy) override;
 };
+
+#endif // _DDD_GDBAgent_GDB_h
@@ -0,0 +1,82 @@
+// GDBAgent derived class to talk to GDB via its machine interface
+//
+// Copyright (c) 2025  Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_GDBAgent_MI_h
+#define _DDD_GDBAgent_MI_h
+
+//-----------------------------------------------------------------------------
+// A GDBAgent_MI runs GDB with `--interpreter=mi3'.  Commands are
+// passed to GDB's console interpreter via `-interpreter-exec', such
+// that all existing command builders still apply.  GDB output is
+// parsed record by record (see MIRecord):
+//
+// - Console and target stream records are passed on as plain text;
+//   hence, all CLI answer parsers keep working unchanged.
+// - `*stopped' and `=thread-selected' records provide the current
+//   frame as structured data; we turn it into a `-fullname' position
+//   annotation.
+// - MI prompts are passed on as `(gdb) ' prompts, except while the
+//   debuggee is running.
+//
+// Only the current position is taken from structured data.
+// Breakpoints, threads, registers, and displays are read from the
+// console output, just as with the CLI.  The results of other
+// records are not parsed at all.
+//-----------------------------------------------------------------------------
+
+#include "GDBAgent_GDB.h"
+#include "MIRecord.h"
+
+class GDBAgent_MI: public GDBAgent_GDB {
+private:
+    string pending_line;	// Incomplete last line of MI output
+    bool running;		// True if debuggee is running
+    bool prompted_on_stop;	// True if we issued a prompt on `*stopped'
+    bool log_seen;		// True if log stream output was seen
+
+    // Report FRAME as position annotation; append it to OUT
+    static void add_position(const MIValue *frame, string& out);
+
+    // Translate MI record RECORD into CLI text; append it to OUT
+    void process_record(const MIRecord& record, string& out);
+
+    // True if LINE may be the beginning of an MI record
+    static bool may_be_mi(const string& line);
+
+    // True if the results of records of TYPE and KLASS are used
+    static bool want_results(MIRecordType type, const string& klass);
+
+public:
+    // Constructor
+    GDBAgent_MI (XtAppContext app_context,
+		 const string& gdb_call,
+		 unsigned nTypes = GDBAgent_NTypes);
+
+    int write_cmd(const string& cmd) override;
+    void filter_input(string& answer) override;
+};
+
+#endif // _DDD_GDBAgent_MI_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -129,6 +129,10 @@ extern void EnableButtonDocs(bool enable = true);
 // Enable or disable all installed text docs.
 extern void EnableTextDocs(bool enable = true);
 
+// Re-fetch tip and documentation for the widget the pointer is in,
+// e.g. because its text has become available.
+extern void RefreshTip();
+
 
 // Data
 
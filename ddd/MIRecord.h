@@ -0,0 +1,117 @@
+// $Id$ -*- C++ -*-
+// Parse GDB/MI output records
+
+// Copyright (C) 2025 Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_MIRecord_h
+#define _DDD_MIRecord_h
+
+//-----------------------------------------------------------------------------
+// GDB/MI output consists of one record per line:
+//
+//   [TOKEN]^CLASS[,RESULT...]     result record (`done', `error', ...)
+//   [TOKEN]*CLASS[,RESULT...]     exec async record (`stopped', ...)
+//   [TOKEN]+CLASS[,RESULT...]     status async record
+//   [TOKEN]=CLASS[,RESULT...]     notify async record (`breakpoint-created')
+//   ~"TEXT"                       console stream record
+//   @"TEXT"                       target stream record
+//   &"TEXT"                       log stream record
+//   (gdb)                         end of output, MI prompt
+//
+// A RESULT is NAME=VALUE, where VALUE is a C string, a tuple
+// {RESULT,...} or a list [VALUE,...] or [RESULT,...].
+//
+// read_mi_record() parses a record in a single pass over the line.
+//-----------------------------------------------------------------------------
+
+#include "base/strclass.h"
+#include "base/bool.h"
+
+#include <vector>
+
+// A (named) MI value
+struct MIValue {
+    enum Kind { String, Tuple, List };
+
+    Kind   kind;
+    string name;		// Name, if part of a result
+    string text;		// Value, if kind == String
+    std::vector<MIValue> items;	// Members, if kind == Tuple or List
+
+    MIValue()
+	: kind(String), name(), text(), items()
+    {}
+
+    // Return the member named NAME, or 0 if there is none
+    const MIValue *find(const char *name) const;
+
+    // Return the text of member NAME, or "" if there is none
+    const string& operator[](const char *name) const;
+};
+
+// Record types
+enum MIRecordType {
+    MI_RESULT  = '^',
+    MI_EXEC    = '*',
+    MI_STATUS  = '+',
+    MI_NOTIFY  = '=',
+    MI_CONSOLE = '~',
+    MI_TARGET  = '@',
+    MI_LOG     = '&',
+    MI_PROMPT  = '(',
+    MI_OTHER   = '?'		// Not MI at all, e.g. debuggee output
+};
+
+struct MIRecord {
+    MIRecordType type;		// Record type
+    string token;		// Token, if any
+    string klass;		// Class (`done', `stopped'...)
+    MIValue results;		// Results, as tuple
+    string text;		// Stream text, or whole line if MI_OTHER
+
+    MIRecord()
+	: type(MI_OTHER), token(), klass(), results(), text()
+    {}
+
+    bool is_async() const
+    {
+	return type == MI_EXEC || type == MI_STATUS || type == MI_NOTIFY;
+    }
+    bool is_stream() const
+    {
+	return type == MI_CONSOLE || type == MI_TARGET || type == MI_LOG;
+    }
+};
+
+// Parse the LENGTH characters of LINE (without trailing newline)
+// into RECORD.  Return false if LINE is no well-formed MI record;
+// in this case, RECORD.type is MI_OTHER and RECORD.text is LINE.
+// If WANT_RESULTS is given and returns false for the record's type
+// and class, results are skipped unchecked and left empty.
+bool read_mi_record(const char *line, int length, MIRecord& record,
+		    bool (*want_results)(MIRecordType type, 
+					 const string& klass) = 0);
+
+#endif // _DDD_MIRecord_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
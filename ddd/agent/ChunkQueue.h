@@ -41,6 +41,18 @@ extern "C" void *memcpy(void *to, const void *from, size_t size);
     ChunkQueue is a character array that grows dynamically.
     Characters can easily be appended at the end and
     removed from the beginning (hence the name "queue").
+
+    Discarding characters from the beginning only advances a start
+    offset; the unused space in front is reclaimed lazily, when
+    appending would otherwise require growing the buffer.  Hence,
+    both appending and discarding take amortized constant time per
+    character, while data() always returns a contiguous,
+    NUL-terminated view of the queue contents.
+
+    To avoid intermediate buffers, readers may also fill the queue
+    in place: reserve(LEN) returns a pointer to at least LEN free
+    characters at the end of the queue, and commit(N) appends the
+    first N characters written there.
 */
 
 class ChunkQueue {
@@ -48,18 +60,51 @@ public:
     DECLARE_TYPE_INFO
 
 private:
+    int _start;		// offset of valid data
     int _length;	// length of valid data
     int _size;		// size of allocated memory
     char *_data;	// data
 
-    // Grow to specific size
+    // Move valid data to a buffer of size NEWSIZE, starting at offset 0
     void grow(int newSize)
     {
-	_size = newSize;
-	char *newData = new char[_size];
-	memcpy(newData, _data, _length);
-	delete[] _data;
-	_data = newData;
+	char *newData = _data;
+	if (newSize != _size)
+	    newData = new char[newSize];
+
+	memmove(newData, _data + _start, _length);
+	newData[_length] = '\0';
+
+	if (newData != _data)
+	    delete[] _data;
+
+	_data  = newData;
+	_size  = newSize;
+	_start = 0;
+    }
+
+    // Make room for LEN more characters (plus a trailing NUL) at the end
+    void make_room(int len)
+    {
+	if (_start + _length + len + 1 <= _size)
+	    return;		// Enough room at the end
+
+	int needed = _length + len + 1;
+	if (needed <= _size && _start >= _length)
+	{
+	    // Reclaim the discarded space in front.  Since at least as
+	    // many characters have been discarded as are moved,
+	    // this is amortized over the earlier discards.
+	    grow(_size);
+	}
+	else
+	{
+	    // Grow geometrically, such that appends are amortized, too
+	    int newSize = _size * 2;
+	    if (newSize < needed)
+		newSize = needed;
+	    grow(newSize);
+	}
     }
 
     ChunkQueue(const ChunkQueue&);
@@ -69,8 +114,11 @@ private:
 public:
     // Constructor
     ChunkQueue(int initialSize = BUFSIZ)
-	: _length(0), _size(initialSize), _data(new char [initialSize])
-    {}
+	: _start(0), _length(0), _size(initialSize + 1), 
+	  _data(new char [initialSize + 1])
+    {
+	_data[0] = '\0';
+    }
 
     // Destructor
     virtual ~ChunkQueue()
@@ -81,12 +129,24 @@ public:
     // Append data <dta> with length <len> at the end
     void append(const char *dta, int len)
     {
-	if (_length + len + 1 > _size)
-	    grow(_length + len + 1);
+	memcpy(reserve(len), dta, len);
+	commit(len);
+    }
+
+    // Return a pointer to at least <len> free characters at the end
+    char *reserve(int len)
+    {
+	make_room(len);
+	return _data + _start + _length;
+    }
+
+    // Append the first <len> characters written to reserve()'s buffer
+    void commit(int len)
+    {
+	assert(len >= 0 && _start + _length + len < _size);
 
-	memcpy(_data + _length, dta, len + 1);
 	_length += len;
-	_data[_length] = '\0';
+	_data[_start + _length] = '\0';
     }
 
     // Discard <len> characters from beginning
@@ -94,24 +154,27 @@ public:
     {
 	assert(len <= _length);
 
-	if (len > 0)
+	if (len >= _length)
+	{
+	    discard();
+	}
+	else if (len > 0)
 	{
-	    if (len < _length)
-		memcpy(_data, _data + len, _length);
+	    _start  += len;
 	    _length -= len;
-	    _data[_length] = '\0';
 	}
     }
 
     // Discard entire queue
     void discard()
     {
+	_start  = 0;
 	_length = 0;
-	_data[_length] = '\0';
+	_data[_start] = '\0';
     }
 
     // Resources
-    const char *data() const { return _data; }
+    const char *data() const { return _data + _start; }
     int length() const { return _length; }
 };
 
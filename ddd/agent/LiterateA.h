@@ -110,11 +110,34 @@ private:
     // Return default value for _block_tty_input
     static bool default_block_tty_input();
 
+    // Non-blocking reads.  Descriptors are made non-blocking on
+    // first use and stay so until abort(); FLAGS are the original
+    // flags to restore (-1 if unchanged).
+    struct NonBlockingFd {
+	int fd;
+	int flags;
+	bool eof;		// True if last read hit EOF or an error
+
+	NonBlockingFd(): fd(-1), flags(-1), eof(false) {}
+    };
+    NonBlockingFd nonblocking[2]; // Input and error
+
+    NonBlockingFd& nonblocking_fd(FILE *fp);
+    void restore_blocking();
+
+    // Statistics
+    long _read_calls;		// Number of read() calls
+    long _read_bytes;		// Number of bytes read
+
 public:
     // Resources
     bool block_tty_input() const     { return _block_tty_input; }
     bool block_tty_input(bool state) { return _block_tty_input = state; }
 
+    // Statistics
+    long read_calls() const { return _read_calls; }
+    long read_bytes() const { return _read_bytes; }
+
 protected:
     // Input data handling
     int readInput(const char*& data);
@@ -138,12 +161,17 @@ protected:
 	return block_tty_input() && isatty(fileno(fp));
     }
 
+    // Check if the last read from FP hit EOF
+    bool at_eof(FILE *fp);
+    void clear_eof(FILE *fp);
+
 public:
     // Constructor for Agent users
     LiterateAgent(XtAppContext app_context, const string& pth,
 		  unsigned nTypes = LiterateAgent_NTypes):
 	AsyncAgent(app_context, pth, nTypes), activeIO(false),
-	_block_tty_input(default_block_tty_input())
+	_block_tty_input(default_block_tty_input()),
+	_read_calls(0), _read_bytes(0)
     {}
 
     // Constructor for Agent writers
@@ -152,20 +180,23 @@ public:
 		  unsigned nTypes = LiterateAgent_NTypes):
 	AsyncAgent(app_context, in, out, err, nTypes), activeIO(false),
 	// When reading from stdin, always block TTY input.
-	_block_tty_input(in == stdin || default_block_tty_input())
+	_block_tty_input(in == stdin || default_block_tty_input()),
+	_read_calls(0), _read_bytes(0)
     {}
 
     // "Dummy" Constructor without any communication
     LiterateAgent(XtAppContext app_context, bool dummy,
 		  unsigned nTypes = LiterateAgent_NTypes):
 	AsyncAgent(app_context, dummy, nTypes), activeIO(false),
-	_block_tty_input(default_block_tty_input())
+	_block_tty_input(default_block_tty_input()),
+	_read_calls(0), _read_bytes(0)
     {}
 
     // Duplicator
     LiterateAgent(const LiterateAgent& lit)
 	: AsyncAgent(lit), activeIO(lit.activeIO),
-	  _block_tty_input(lit.block_tty_input())
+	  _block_tty_input(lit.block_tty_input()),
+	  _read_calls(0), _read_bytes(0)
     {}
     virtual Agent *dup() const { return new LiterateAgent(*this); }
 
@@ -38,5 +38,40 @@ inline unsigned int multiplicativehash(int x)
 
 unsigned int foldhash(double);
 
+// 64-bit FNV-1a hash of the LENGTH bytes at X, continuing from H.
+// Unlike the above, this is suitable for telling large texts apart.
+const unsigned long long FNV_OFFSET_BASIS = 14695981039346656037ULL;
+unsigned long long hashfnv(const char *x, int length, 
+			   unsigned long long h = FNV_OFFSET_BASIS);
+
+// Hash values of keys in hashed containers (see `template/Assoc.h').
+// The hash value of a `string' is defined in `base/strclass.h'.
+inline unsigned int hash_key(int x)
+{
+    return multiplicativehash(x);
+}
+
+inline unsigned int hash_key(unsigned int x)
+{
+    return multiplicativehash(int(x));
+}
+
+inline unsigned int hash_key(long x)
+{
+    return multiplicativehash(int(x ^ (x >> 16 >> 16)));
+}
+
+inline unsigned int hash_key(unsigned long x)
+{
+    return hash_key(long(x));
+}
+
+template<class T>
+inline unsigned int hash_key(const T *p)
+{
+    // Heap objects are aligned; the lowest bits carry no information
+    return hash_key((unsigned long)p >> 4);
+}
+
 #endif // _DDD_hash_h
 // DON'T ADD ANYTHING BEHIND THIS #endif
@@ -62,9 +62,11 @@ protected:
     regex_t compiled;		// "^" + regexp
     char prefix[32];		// constant prefix (for faster search)
 
-    regmatch_t *exprs;		// Matched expressions
     size_t nexprs() const;	// Number of expressions
 
+    // Matched expressions of the last match in this thread
+    regmatch_t *match_exprs() const;
+
     // Fatal error ERRCODE with regexp source SRC
     void fatal(int errcode, const char *src = 0);
 
@@ -105,7 +107,8 @@ public:
 #if WITH_RUNTIME_REGEX
     // Return matching info for NTH expression in START and LENGTH
     // Expression 0 is the entire regexp T; expression 1 and later are
-    // the subexpressions of T.  Returns true iff successful.
+    // the subexpressions of T.  Returns true iff successful.  This
+    // refers to the last search or match in the calling thread.
     bool match_info(int& start, int& length, int nth = 0) const;
 #endif
 
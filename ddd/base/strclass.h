@@ -412,6 +412,7 @@ License along with this library; if not, see <http://www.gnu.org/licenses/>.
 #include "bool.h"
 #include "assert.h"
 #include "casts.h"
+#include "hash.h"
 #include "attribute.h"
 
 #ifndef STRING_CHECK_CONSUME
@@ -1047,9 +1048,13 @@ inline string& string::operator = (const char* t)
 {
     if (*t == '\0')
     {
-	// Assignment of empty string
-	rep->s += rep->len;
-	rep->len = 0;
+	// Assignment of empty string.  Don't write to an empty
+	// representation; it may be the shared _nilstrRep.
+	if (rep->len > 0)
+	{
+	    rep->s += rep->len;
+	    rep->len = 0;
+	}
     }
     else if (t >= rep->s && t < rep->s + rep->len)
     {
@@ -1947,6 +1952,12 @@ inline std::ostream& operator<<(std::ostream& s, const subString& x)
     s.write(x.chars(), x.length()); return s;
 }
 
+// Hashing (for hashed containers)
+inline unsigned int hash_key(const string& x)
+{
+    return hashpjw(x.chars());
+}
+
 // A zillion comparison operators - for every combination of char,
 // char *, const char *, string, and subString.
 #define string_COMPARE(op, t1, t2) \
@@ -0,0 +1,66 @@
+// $Id$ -*- C++ -*-
+// Batched drawing of box contents
+
+// Copyright (c) 2025  Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_DrawBatch_h
+#define _DDD_DrawBatch_h
+
+// Drawing a box with many strings and lines used to issue one X
+// request per string and per line.  While a box is drawn, DrawBatch
+// collects glyphs (per color) and line segments (per GC) instead;
+// they are submitted using one XftDrawGlyphFontSpec() and one
+// XDrawSegments() call each as soon as the outermost box is done.
+//
+// Boxes that draw directly or change a GC must call flush() first,
+// such that everything collected so far is drawn in order and with
+// the GC values it was meant for.
+
+#include <X11/Xft/Xft.h>
+#include <X11/Intrinsic.h>
+
+class DrawBatch {
+    DrawBatch();		// No instances
+
+public:
+    // Start collecting.  Calls may be nested.
+    static void begin();
+
+    // Stop collecting.  At the outermost level, submit everything.
+    static void end();
+
+    // Draw the LENGTH UTF-8 chars in S in FONT and COLOR; the
+    // baseline starts at (X, Y).  Like XftDrawStringUtf8().
+    static void drawString(Widget w, XftFont *font, const XftColor& color,
+			   int x, int y, const char *s, int length);
+
+    // Draw a line from (X1, Y1) to (X2, Y2).  Like XDrawLine().
+    static void drawLine(Widget w, GC gc, int x1, int y1, int x2, int y2);
+
+    // Submit everything collected so far
+    static void flush();
+};
+
+#endif // _DDD_DrawBatch_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -0,0 +1,78 @@
+// $Id$ -*- C++ -*-
+// Where boxes and graphs draw into
+
+// Copyright (c) 2025  Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_DrawTarget_h
+#define _DDD_DrawTarget_h
+
+// Boxes and graphs draw into the window of their widget.  While a
+// DrawTarget exists, drawing on behalf of its widget goes into
+// another drawable instead - typically an off-screen pixmap covering
+// only part of the widget.  Drawing code uses widget coordinates and
+// translates them by dx() and dy().
+
+#include <X11/Intrinsic.h>
+
+class DrawTarget {
+    Widget _old_widget;
+    Drawable _old_drawable;
+    int _old_x;
+    int _old_y;
+
+    static Widget current_widget;
+    static Drawable current_drawable;
+    static int current_x;
+    static int current_y;
+
+    DrawTarget(const DrawTarget&);
+    DrawTarget& operator = (const DrawTarget&);
+
+public:
+    // Draw into D on behalf of W.  The point (X, Y) of W is at
+    // (0, 0) in D.
+    DrawTarget(Widget w, Drawable d, int x = 0, int y = 0);
+
+    // Restore previous target
+    ~DrawTarget();
+
+    // The drawable to draw into on behalf of W
+    static Drawable get(Widget w)
+    {
+	return w == current_widget ? current_drawable : XtWindow(w);
+    }
+
+    // To be added to W coordinates when drawing into get(W)
+    static int dx(Widget w)
+    {
+	return w == current_widget ? -current_x : 0;
+    }
+    static int dy(Widget w)
+    {
+	return w == current_widget ? -current_y : 0;
+    }
+};
+
+#endif // _DDD_DrawTarget_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
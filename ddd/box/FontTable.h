@@ -36,11 +36,28 @@
 #include "base/TypeInfo.h"
 #include "base/assert.h"
 
+#include <map>
+
 
 typedef XftFont BoxFont;
 
 #define MAX_FONTS 511 /* Max #Fonts */
 
+// Glyph metrics of the 256 characters of a font, as used by
+// XftTextExtents8().  Entries are filled in on first use.
+struct FontMetrics {
+    short x[256];		// Left bearing (XGlyphInfo::x)
+    short width[256];		// Ink width (XGlyphInfo::width)
+    short xOff[256];		// Advance (XGlyphInfo::xOff)
+    bool known[256];		// True if entry has been filled in
+
+    FontMetrics()
+    {
+	for (int i = 0; i < 256; i++)
+	    known[i] = false;
+    }
+};
+
 struct FontTableHashEntry {
     BoxFont *font;
     string name;
@@ -60,12 +77,21 @@ private:
     FontTableHashEntry table[MAX_FONTS];
     Display *_display;
 
+    // Metrics, by font
+    std::map<BoxFont *, FontMetrics *> _metrics;
+
+    // Most recently measured font
+    BoxFont *_last_font;
+    FontMetrics *_last_metrics;
+
+    FontMetrics *metrics(BoxFont *font);
+
     FontTable(const FontTable&);
     FontTable& operator = (const FontTable&);
 
 public:
     FontTable(Display *display):
-	_display(display)
+	_display(display), _last_font(0), _last_metrics(0)
     {
 	for (unsigned i = 0; i < MAX_FONTS; i++)
 	{
@@ -76,10 +102,17 @@ public:
 
     virtual ~FontTable()
     {
+	std::map<BoxFont *, FontMetrics *>::iterator it;
+	for (it = _metrics.begin(); it != _metrics.end(); ++it)
+	    delete it->second;
     }
 
     BoxFont *operator[](const string& name);
 
+    // Same as XftTextExtents8(), but using cached glyph metrics
+    void textExtents(BoxFont *font, const char *s, int length,
+		     XGlyphInfo& extents);
+
     Display *getDisplay() {return _display;}
 };
 
@@ -0,0 +1,58 @@
+// $Id$ -*- C++ -*-
+// Cached Xft drawing contexts and colors
+
+// Copyright (c) 2025  Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_XftCache_h
+#define _DDD_XftCache_h
+
+// Creating an XftDraw and looking up a color for every string drawn
+// is expensive - XQueryColor() is a server round trip.  XftCache
+// keeps one XftDraw per widget and one XftColor per pixel value.
+// Draws are destroyed along with their widget; colors are flushed
+// as soon as a widget's colormap changes.
+
+#include <X11/Xft/Xft.h>
+#include <X11/Intrinsic.h>
+
+class XftCache {
+    XftCache();			// No instances
+
+public:
+    // An XftDraw for drawing into D on behalf of W.  If D is None,
+    // draw into the current target of W (see DrawTarget).
+    static XftDraw *draw(Widget w, Drawable d = None);
+
+    // The XftColor with pixel value PIXEL on the display of W
+    static const XftColor *color(Widget w, Pixel pixel);
+
+    // The XftColor of the foreground of GC
+    static const XftColor *foreground(Widget w, GC gc);
+
+    // Forget all colors
+    static void flush_colors();
+};
+
+#endif // _DDD_XftCache_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -53,6 +53,9 @@ extern void gdb_out(const string& text);
 // Output TEXT in GDB window (unconditionally)
 extern void _gdb_out(const string& text);
 
+// Insert GDB output that is still pending in the GDB window
+extern void flush_gdb_out();
+
 // Update option menus
 extern void update_options();
 
@@ -102,6 +102,9 @@ bool is_core_cmd(const string& cmd);
 // True if CMD changes the current thread
 bool is_thread_cmd(const string& cmd);
 
+// True if CMD may change the current inferior
+bool is_inferior_cmd(const string& cmd);
+
 // True if CMD changes variable values.
 bool is_assign_cmd(const string& cmd, GDBAgent *gdb);
 
@@ -145,6 +148,9 @@ bool is_graph_cmd(const string& cmd);
 // True if CMD is an internal `graph refresh' command.
 bool is_refresh_cmd(const string& cmd);
 
+// True if CMD is an internal `graph timing' command.
+bool is_timing_cmd(const string& cmd);
+
 // True if CMD is a `print' command.
 bool is_print_cmd(const string& cmd, GDBAgent *gdb);
 
@@ -35,6 +35,10 @@
 #include "box/Box.h"
 #include "base/TypeInfo.h"
 
+#include <vector>
+
+class GraphIndex;
+
 class Graph {
 public:
     DECLARE_TYPE_INFO
@@ -42,9 +46,13 @@ public:
 private:
     GraphNode *_firstNode;	// circular list (0 if empty)
     GraphEdge *_firstEdge;	// circular list (0 if empty)
+    mutable GraphIndex *_index;	// spatial index (0 if not built yet)
 
     Graph& operator = (const Graph&);
 
+    // Return the spatial index, building it if needed
+    const GraphIndex& index() const;
+
     void begin_color(std::ostream& os, const PrintGC& gc,
 		     unsigned short red,
 		     unsigned short green,
@@ -72,7 +80,7 @@ protected:
 public:
     // Constructors
     Graph():
-	_firstNode(0), _firstEdge(0)
+	_firstNode(0), _firstEdge(0), _index(0)
     {}
 
     // Destructor
@@ -168,6 +176,16 @@ public:
     void makeEdgeFirst(GraphEdge *edge);
     void makeEdgeLast(GraphEdge *edge);
 
+    // Notify graph that the region of NODE has changed
+    void nodeChanged(GraphNode *node);
+
+    // Visible nodes and edges that may intersect R when drawn with
+    // GC, in list order.  Callers must check for actual intersection.
+    void findNodes(const BoxRegion& r, const GraphGC& gc,
+		   std::vector<GraphNode *>& nodes) const;
+    void findEdges(const BoxRegion& r, const GraphGC& gc,
+		   std::vector<GraphEdge *>& edges) const;
+
     // Drawing
     void draw(Widget w, const BoxRegion& exposed, const GraphGC& gc) const;
     void draw(Widget w, const BoxRegion& exposed) const
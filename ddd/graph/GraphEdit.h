@@ -94,6 +94,7 @@ class GraphNode;
 #define XtNselfEdgePosition         "selfEdgePosition"
 #define XtNselfEdgeDirection        "selfEdgeDirection"
 #define XtNdashedLines              "dashedLines"
+#define XtNdoubleBuffer             "doubleBuffer"
 
 
 
@@ -125,6 +126,7 @@ class GraphNode;
 #define XtCSelfEdgePosition  "SelfEdgePosition"
 #define XtCSelfEdgeDirection "SelfEdgeDirection"
 #define XtCDashedLines       "DashedLines"
+#define XtCDoubleBuffer      "DoubleBuffer"
 #define XtCDataDarkMode      "DataDarkMode"
 
 
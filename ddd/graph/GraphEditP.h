@@ -45,6 +45,8 @@ extern "C" {
 #include "GraphEdit.h"
 #include "Graph.h"
 
+#include <vector>
+
 
 // The GraphEdit class record
 
@@ -85,6 +87,9 @@ typedef struct _GraphEditPart {
     Boolean rubberAnnotations;	// Draw annotations when moving
     Boolean opaqueMove;		// Draw nodes  when moving
 
+    // Drawing stuff
+    Boolean doubleBuffer;	// Draw via off-screen pixmap?
+
     // Selection stuff
     Boolean autoRaise;		// Raise selected nodes?
 
@@ -188,6 +193,17 @@ typedef struct _GraphEditPartPrivate {
     GraphGC graphGC;		// Graph graphic context
 
     Pixmap gridPixmap;		// Grid pixmap
+    GC backgroundGC;		// Graphic context for the background
+
+    Pixmap backBuffer;		// Off-screen copy of the visible part
+    Position backX;		// Position of backBuffer in the widget
+    Position backY;
+    Dimension backWidth;	// Size of backBuffer
+    Dimension backHeight;
+    Boolean backValid;		// Flag: backBuffer is up to date
+    GC copyGC;			// Graphic context for copying backBuffer
+
+    std::vector<BoxRegion> *damage; // Regions to be redrawn
 
     Boolean sizeChanged;	// Flag: size changed in SetValues
     Boolean redisplayEnabled;	// Flag: redisplay is enabled
@@ -0,0 +1,159 @@
+// $Id$ -*- C++ -*-
+// Spatial index over graph nodes and edges
+
+// Copyright (c) 2025  Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_GraphIndex_h
+#define _DDD_GraphIndex_h
+
+// A uniform grid over the regions of graph nodes and edges, such
+// that drawing an exposed area or finding the node at some point
+// need not visit each node and edge.
+//
+// The index is conservative: queries return all items whose cells
+// intersect the query region (in graph list order), and callers
+// apply the exact tests.
+
+#include "box/BoxRegion.h"
+
+#include <unordered_map>
+#include <vector>
+
+class GraphNode;
+class GraphEdge;
+
+template<class T>
+class GraphGrid {
+    enum { CELL_SIZE = 128 };	// Cell width and height (in pixels)
+
+    struct Entry {
+	BoxRegion bounds;	// Indexed region
+	bool bounded;		// False: always returned
+	long rank;		// Position in graph list
+    };
+
+    std::unordered_map<T *, Entry> _entries;
+    std::unordered_map<long long, std::vector<T *> > _cells;
+    int _unbounded;		// #entries with BOUNDED == false
+    long _min_rank;
+    long _max_rank;
+
+    // Range of cells ever used
+    long _lo[2];
+    long _hi[2];
+
+    static long cell(long c)
+    {
+	return c >= 0 ? c / CELL_SIZE : -((-c - 1) / CELL_SIZE) - 1;
+    }
+
+    static long long key(long x, long y)
+    {
+	return (long long)x << 32 ^ (unsigned long)(y & 0xffffffffL);
+    }
+
+    // Compute cells covered by R (clipped to the cells in use)
+    bool cells(const BoxRegion& r, long lo[2], long hi[2]) const;
+
+    void link(T *item, const Entry& e);
+    void unlink(T *item, const Entry& e);
+
+    GraphGrid(const GraphGrid&);
+    GraphGrid& operator = (const GraphGrid&);
+
+public:
+    GraphGrid();
+
+    // Add ITEM occupying BOUNDS after all other items, or update
+    // the bounds of ITEM.  If BOUNDED is false, ITEM is returned by
+    // every query.
+    void insert(T *item, const BoxRegion& bounds, bool bounded = true);
+
+    // Remove ITEM
+    void remove(T *item);
+
+    // True if ITEM is indexed
+    bool contains(T *item) const
+    {
+	return _entries.find(item) != _entries.end();
+    }
+
+    // Place ITEM before or after all other items
+    void makeFirst(T *item);
+    void makeLast(T *item);
+
+    // Append all items whose cells intersect R to FOUND, in order
+    void find(const BoxRegion& r, std::vector<T *>& found) const;
+
+    // True if R covers all cells in use
+    bool covers(const BoxRegion& r) const;
+};
+
+class GraphIndex {
+    GraphGrid<GraphNode> _nodes;
+    GraphGrid<GraphEdge> _edges;
+
+    GraphIndex(const GraphIndex&);
+    GraphIndex& operator = (const GraphIndex&);
+
+public:
+    GraphIndex()
+	: _nodes(), _edges()
+    {}
+
+    // Add or update NODE; also update its edges
+    void insert(GraphNode *node);
+
+    // Add or update EDGE
+    void insert(GraphEdge *edge);
+
+    // Remove NODE or EDGE
+    void remove(GraphNode *node) { _nodes.remove(node); }
+    void remove(GraphEdge *edge) { _edges.remove(edge); }
+
+    // Change order
+    void makeFirst(GraphNode *node) { _nodes.makeFirst(node); }
+    void makeLast(GraphNode *node)  { _nodes.makeLast(node); }
+    void makeFirst(GraphEdge *edge) { _edges.makeFirst(edge); }
+    void makeLast(GraphEdge *edge)  { _edges.makeLast(edge); }
+
+    // Find nodes and edges that may intersect R
+    void find(const BoxRegion& r, std::vector<GraphNode *>& nodes) const
+    {
+	_nodes.find(r, nodes);
+    }
+    void find(const BoxRegion& r, std::vector<GraphEdge *>& edges) const
+    {
+	_edges.find(r, edges);
+    }
+
+    // True if R covers all nodes
+    bool covers(const BoxRegion& r) const
+    {
+	return _nodes.covers(r) && _edges.covers(r);
+    }
+};
+
+#endif // _DDD_GraphIndex_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -76,6 +76,9 @@ protected:
 	count(0)
     {}
 
+    // Notify graph that region has changed
+    void regionChanged();
+
 public:
     int count;			// #predecessors (used in layout algorithms)
 
@@ -30,7 +30,15 @@
 
 #include "base/strclass.h"
 
-extern void logplayer(const string& logname);
+// How to answer commands
+enum LogPlayMode {
+    PLAY_INTERACTIVE,		// Wait for commands; allow searching the log
+    PLAY_FAST,			// Answer DDD commands as fast as possible
+    PLAY_RECORDED		// Answer DDD commands with the recorded delays
+};
+
+extern void logplayer(const string& logname, 
+		      LogPlayMode mode = PLAY_INTERACTIVE);
 
 #endif // _DDD_logplayer_h
 // DON'T ADD ANYTHING BEHIND THIS #endif
@@ -0,0 +1,64 @@
+// $Id$ -*- C++ -*-
+// Direct access to debuggee memory
+
+// Copyright (c) 2025  Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_procmem_h
+#define _DDD_procmem_h
+
+#include "base/strclass.h"
+#include "base/bool.h"
+
+#include <vector>
+
+// If the debuggee is a local process traced by GDB, its memory is
+// read directly from `/proc/PID/mem'; read pages are cached until
+// the next user command.  Otherwise, GDB is asked to dump the memory.
+
+// Read LENGTH bytes of debuggee memory at ADDRESS into DATA.  Return
+// false (and an error message in ERROR) if the memory cannot be read.
+bool read_memory(unsigned long address, long length, 
+		 std::vector<char>& data, string& error);
+
+// Write debuggee memory from START to END (addresses, as in `0x1000'
+// or `0x1000+4*25') into FILE, like GDB `dump binary memory'.  Return
+// "" on success, and the error message otherwise.
+string dump_memory(const string& file, const string& start, 
+		   const string& end);
+
+// Fetch the address from ANSWER (as in `$1 = (int *) 0x1000 <x>');
+// return false if there is none
+bool read_address(const string& answer, unsigned long& address);
+
+// Forget all cached memory.  To be called whenever the debuggee
+// might run or change its memory.
+void clear_memory_cache();
+
+// Forget the debuggee process, too.  To be called whenever a
+// debuggee might have been started, attached, or terminated, and
+// whenever GDB might switch to another inferior.
+void clear_debuggee_pid();
+
+#endif // _DDD_procmem_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -31,6 +31,8 @@
 #include "base/strclass.h"
 #include "base/bool.h"
 
+#include <vector>
+
 // Send COMMAND to GDB; return answer (NO_GDB_ANSWER if none)
 // TIMEOUT is either 0 (= use default timeout), -1 (= no timeout)
 // or maximal time in seconds
@@ -39,6 +41,29 @@ string gdb_question(const string& command, int timeout = 0,
 
 const string NO_GDB_ANSWER(char(-1));
 
+// Called with the answers to asynchronous questions, in the order
+// of the questions (NO_GDB_ANSWER if none)
+typedef void (*GDBAnswersProc)(const std::vector<string>& answers,
+			       void *data);
+
+// Send COMMANDS to GDB without waiting for the answers; call PROC
+// with the answers and DATA when they arrive.  PROC is called
+// exactly once.  All questions submitted until control returns to
+// the event loop are sent to GDB as one batch, such that
+// independent questions share round trips.  If GDB is busy when the
+// batch is sent, all answers are NO_GDB_ANSWER.  TIMEOUT is as in
+// gdb_question(); if GDB does not answer in time, PROC is called
+// with NO_GDB_ANSWER answers, and the late answers are ignored.
+void gdb_questions_async(const std::vector<string>& commands,
+			 GDBAnswersProc proc, void *data = 0,
+			 int timeout = 0);
+
+// Send COMMANDS to GDB as one batch (joining any pending
+// asynchronous questions); return the answers.  TIMEOUT is as in
+// gdb_question().
+std::vector<string> gdb_questions(const std::vector<string>& commands,
+				  int timeout = 0);
+
 extern bool gdb_question_running; // Is gdb_question running?
 
 // Helper: weed out GDB `verbose' stuff.
@@ -166,6 +166,7 @@ extern const regex rxstruct_end;
 extern const regex rxstruct_keyword_begin;
 extern const regex rxterminated;
 extern const regex rxthread_cmd;
+extern const regex rxtiming_cmd;
 extern const regex rxundisplay;
 extern const regex rxup_cmd;
 extern const regex rxuppercase;
@@ -69,6 +69,11 @@ inline string session_log_file()
     return session_file(DEFAULT_SESSION, "log");
 }
 
+inline string session_console_file()
+{
+    return session_file(DEFAULT_SESSION, "console");
+}
+
 inline string session_tips_file()
 {
     return session_file(DEFAULT_SESSION, "tips");
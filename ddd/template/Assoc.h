@@ -31,9 +31,16 @@
 
 #include "base/bool.h"
 #include "base/assert.h"
+#include "base/hash.h"
 
 #include <stdlib.h>		// abort()
 
+// Entries are kept in a list, most recently inserted first; this is
+// the order in which AssocIter visits them.  As soon as an Assoc has
+// ASSOC_HASH_MIN entries, an additional hash index (using `hash_key()'
+// on keys) is built for lookups.
+const int ASSOC_HASH_MIN = 8;
+
 template<class K, class V> class AssocMark;
 template<class K, class V> class _Assoc;
 template<class K, class V> class Assoc;
@@ -47,6 +54,9 @@ class AssocRec {
 
 private:
     AssocRec<K,V> *next;		// For Assoc usage only
+    AssocRec<K,V> *prev;		// Ditto
+    AssocRec<K,V> *hash_next;		// Next entry in same hash bucket
+    unsigned int hash;			// hash_key(key)
 
 public:
     K key;
@@ -54,10 +64,10 @@ public:
     
     // Constructor
     AssocRec(const K& k, const V& v)
-	: next(0), key(k), value(v)
+	: next(0), prev(0), hash_next(0), hash(hash_key(k)), key(k), value(v)
     {}
     AssocRec(const K& k)
-	: next(0), key(k)
+	: next(0), prev(0), hash_next(0), hash(hash_key(k)), key(k)
     {}
 
 private:
@@ -70,12 +80,80 @@ class _Assoc {
     friend class AssocMark<K,V>;
 
 protected:
-    AssocRec<K,V> *entries;	// Entries
+    AssocRec<K,V> *entries;	// Entries, newest first
+    AssocRec<K,V> **buckets;	// Hash index; 0 if not built yet
+    int n_buckets;		// Number of buckets (a power of 2)
+    int n_entries;		// Number of entries
+
+    // The hash bucket for hash value H
+    AssocRec<K,V> *& bucket(unsigned int h) const
+    {
+	return buckets[h & (n_buckets - 1)];
+    }
+
+    // Rebuild the hash index, making room for twice as many entries
+    void rehash()
+    {
+	int size = ASSOC_HASH_MIN;
+	while (size < n_entries * 2)
+	    size *= 2;
+
+	delete[] buckets;
+	buckets = new AssocRec<K,V> *[size];
+	n_buckets = size;
+	for (int i = 0; i < n_buckets; i++)
+	    buckets[i] = 0;
+
+	// Add oldest entries first, such that newer entries
+	// (which hide older ones with the same key) come first
+	AssocRec<K,V> *last = entries;
+	while (last != 0 && last->next != 0)
+	    last = last->next;
+
+	for (AssocRec<K,V> *e = last; e != 0; e = e->prev)
+	{
+	    AssocRec<K,V> *& b = bucket(e->hash);
+	    e->hash_next = b;
+	    b = e;
+	}
+    }
+
+    // Remove entry E and delete it
+    void unlink(AssocRec<K,V> *e)
+    {
+	if (e->prev == 0)
+	    entries = e->next;
+	else
+	    e->prev->next = e->next;
+	if (e->next != 0)
+	    e->next->prev = e->prev;
+
+	if (buckets != 0)
+	{
+	    AssocRec<K,V> **p = &bucket(e->hash);
+	    while (*p != e)
+		p = &(*p)->hash_next;
+	    *p = e->hash_next;
+	}
+
+	delete e;
+	n_entries--;
+    }
 
     virtual AssocRec<K,V> *lookup(const K& key) const
     {
-	for (AssocRec<K,V> *e = entries; e != 0; e = e->next)
-	    if (key == e->key)
+	if (buckets == 0)
+	{
+	    for (AssocRec<K,V> *e = entries; e != 0; e = e->next)
+		if (key == e->key)
+		    return e;
+
+	    return 0;
+	}
+
+	unsigned int h = hash_key(key);
+	for (AssocRec<K,V> *e = bucket(h); e != 0; e = e->hash_next)
+	    if (e->hash == h && key == e->key)
 		return e;
 
 	return 0;
@@ -85,7 +163,23 @@ protected:
     {
 	AssocRec<K,V> *e = new AssocRec<K,V>(key);
 	e->next = entries;
-	return entries = e;
+	if (entries != 0)
+	    entries->prev = e;
+	entries = e;
+	n_entries++;
+
+	if (n_entries >= ASSOC_HASH_MIN && n_entries > n_buckets)
+	{
+	    rehash();
+	}
+	else if (buckets != 0)
+	{
+	    AssocRec<K,V> *& b = bucket(e->hash);
+	    e->hash_next = b;
+	    b = e;
+	}
+
+	return e;
     }
 
 private:
@@ -99,12 +193,17 @@ private:
           delete e;
       }
       entries = 0;
+
+      delete[] buckets;
+      buckets = 0;
+      n_buckets = 0;
+      n_entries = 0;
    }
 
 public:
     // Constructors
     _Assoc():
-	entries(0)
+	entries(0), buckets(0), n_buckets(0), n_entries(0)
     {}
 
     // Destructor
@@ -151,27 +250,20 @@ public:
 	if (n == 0)
 	    return;
 
-	AssocRec<K,V> *prev = 0;
-	AssocRec<K,V> *e = entries;
+	// Without index, all entries are candidates
+	unsigned int h = hash_key(key);
+	AssocRec<K,V> *e = (buckets != 0 ? bucket(h) : entries);
 	while (e != 0)
 	{
-	    AssocRec<K,V> *next = e->next;
+	    AssocRec<K,V> *next = (buckets != 0 ? e->hash_next : e->next);
 
-	    if (key == e->key)
+	    if (e->hash == h && key == e->key)
 	    {
-		if (prev == 0)
-		    entries = next;
-		else
-		    prev->next = next;
-		delete e;
+		unlink(e);
 
 		if (--n == 0)
 		    return;
 	    }
-	    else
-	    {
-		prev = e;
-	    }
 
 	    e = next;
 	}
@@ -179,7 +271,7 @@ public:
 
     // Copy constructor
     _Assoc(const _Assoc<K,V>& m):
-	entries(0)
+	entries(0), buckets(0), n_buckets(0), n_entries(0)
     {
 	for (AssocRec<K,V> *e = m.entries; e != 0; e = e->next)
 	    (*this)[e->key] = e->value;
@@ -190,9 +282,7 @@ public:
     {
 	if (this != &m)
 	{
-	    if (entries)
-		destroyAll();
-	    entries = 0;
+	    destroyAll();
 
 	    for (AssocRec<K,V> *e = m.entries; e != 0; e = e->next)
 		(*this)[e->key] = e->value;
@@ -298,17 +388,8 @@ public:
     // Truncate array up to assoc iterator
     void release (const AssocMark<K, V>& mark)
     {
-	AssocRec<K, V> *e = this->entries;
-
-	while (e != 0 && e != mark.rec)
-	{
-	    AssocRec<K, V> *tmp = e;
-	    e = e->next;
-	    tmp->next = 0;
-	    delete tmp;
-	}
-
-	this->entries = e;
+	while (this->entries != 0 && this->entries != mark.rec)
+	    this->unlink(this->entries);
     }
 
     // Constructor
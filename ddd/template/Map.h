@@ -28,7 +28,8 @@
 //-----------------------------------------------------------------------------
 // A Map Template
 // The Key should not be 0, since this value has special meaning for
-// first() and next().  Also, '==' must be defined for Key.
+// first() and next().  Also, '==' and `hash_key()' must be defined for Key.
+// Elements are visited most recently inserted first.
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
@@ -37,9 +38,13 @@
 
 #include "base/bool.h"
 #include "base/assert.h"
+#include "base/hash.h"
 
 typedef void *MapRef;
 
+// Minimum number of buckets in the hash index
+const int MAP_HASH_MIN = 16;
+
 template <class Key, class Contents>
 class Map {
     // Internal list node
@@ -47,27 +52,61 @@ class Map {
 	Key key;
 	Contents *cont;
 	MapNode *_next;
+	MapNode *_prev;
+	MapNode *_hash_next;	// Next node in same hash bucket
+	unsigned int _hash;	// hash_key(key)
     };
 
 private:
     MapNode *_first;
     int _length;
+    MapNode **_buckets;		// Hash index; 0 if empty
+    int _n_buckets;		// Number of buckets (a power of 2)
+
+    // The hash bucket for hash value H
+    MapNode *& bucket(unsigned int h) const
+    {
+	return _buckets[h & (_n_buckets - 1)];
+    }
+
+    // Rebuild the hash index with room for twice as many elements
+    void rehash()
+    {
+	int size = MAP_HASH_MIN;
+	while (size < _length * 2)
+	    size *= 2;
+
+	delete[] _buckets;
+	_buckets = new MapNode *[size];
+	_n_buckets = size;
+	for (int i = 0; i < _n_buckets; i++)
+	    _buckets[i] = 0;
+
+	for (MapNode *ln = _first; ln != 0; ln = ln->_next)
+	{
+	    MapNode *& b = bucket(ln->_hash);
+	    ln->_hash_next = b;
+	    b = ln;
+	}
+    }
 
     // Search K; return 0 if not found
     MapNode *search(Key k) const
     {
-	MapNode *ln;
-	
-	ln = _first;
-	while (ln != 0 && !(ln->key == k)) 
-	    ln = ln->_next;
+	if (_buckets == 0)
+	    return 0;
+
+	unsigned int h = hash_key(k);
+	MapNode *ln = bucket(h);
+	while (ln != 0 && !(ln->_hash == h && ln->key == k))
+	    ln = ln->_hash_next;
 	return ln;
     }
 
 public:
     // Create empty map
     Map()
-	: _first(0), _length(0) 
+	: _first(0), _length(0), _buckets(0), _n_buckets(0)
     {}
 
     // Remove all elements
@@ -84,6 +123,10 @@ public:
 	}
 	_first = 0;
 	_length = 0;
+
+	delete[] _buckets;
+	_buckets = 0;
+	_n_buckets = 0;
     }
 
     // Remove all elements, delete'ing each content
@@ -100,6 +143,10 @@ public:
 	}
 	_first = 0;
 	_length = 0;
+
+	delete[] _buckets;
+	_buckets = 0;
+	_n_buckets = 0;
     }
 
     
@@ -122,10 +169,25 @@ public:
 	    ln = new MapNode;
 	    ln->key = k;
 	    ln->cont = c;
+	    ln->_hash = hash_key(k);
 
+	    ln->_prev = 0;
 	    ln->_next = _first;
+	    if (_first != 0)
+		_first->_prev = ln;
 	    _first = ln;
 	    _length++;
+
+	    if (_length > _n_buckets)
+	    {
+		rehash();
+	    }
+	    else
+	    {
+		MapNode *& b = bucket(ln->_hash);
+		ln->_hash_next = b;
+		b = ln;
+	    }
 	}
 	else
 	{
@@ -138,35 +200,31 @@ public:
     // Delete K if found
     void del(Key k)
     {
-	if (_first == 0)
-	    return;
-    
-	MapNode *prev = 0;
-	MapNode *ln = _first;
-    
-	while (ln != 0 && !(ln->key == k))
-	{
-	    prev = ln;
-	    ln = ln->_next;
-	}
-
+	MapNode *ln = search(k);
 	if (ln == 0)
 	    return; // not found
-		       
-	if (prev == 0)
+
+	if (ln->_prev == 0)
 	{
 	    // delete first element
 	    assert(_first == ln);
-	    _first = _first->_next;
-	    delete ln;
-	    _length--;
+	    _first = ln->_next;
 	}
 	else
 	{
-	    prev->_next = ln->_next;
-	    delete ln;
-	    _length--;
+	    ln->_prev->_next = ln->_next;
 	}
+	if (ln->_next != 0)
+	    ln->_next->_prev = ln->_prev;
+
+	MapNode **p = &bucket(ln->_hash);
+	while (*p != ln)
+	    p = &(*p)->_hash_next;
+	*p = ln->_hash_next;
+
+	delete ln;
+	_length--;
+
 	assert(!contains(k));
     }
 
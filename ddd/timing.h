@@ -0,0 +1,132 @@
+// $Id$ -*- C++ -*-
+// Per-command latency measurements
+
+// Copyright (c) 2025  Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_timing_h
+#define _DDD_timing_h
+
+#include "base/strclass.h"
+#include "base/bool.h"
+
+// The measured phases.  The first four are taken in the debugger
+// channel: from writing a command to the first byte of the reply
+// (GDB), to the prompt (TRANSFER), and from the prompt until the
+// reply is processed (ANSWER).  PARSE to EXPOSE are taken while
+// processing the reply; they are accounted to the command being
+// processed.  STOP is the wall time of a running command, including
+// all follow-up queries.
+enum TimingPhase {
+    TIMING_GDB,			// Write -> first byte
+    TIMING_TRANSFER,		// First byte -> prompt
+    TIMING_ANSWER,		// Prompt -> on_answer done
+    TIMING_TOTAL,		// Write -> on_answer done
+    TIMING_PARSE,		// Parsing display values
+    TIMING_REUSE,		// ... thereof updates reusing old values
+    TIMING_BOX,			// Building display boxes
+    TIMING_LAYOUT,		// Graph layout
+    TIMING_EXPOSE,		// Redrawing the graph
+    TIMING_STOP,		// Running command -> DDD idle again
+
+    TIMING_PHASES		// Number of phases
+};
+
+// Enable or disable collection
+void set_timing(bool enabled);
+bool timing();
+
+// Current time in microseconds
+double timing_now();
+
+// The kind of CMD (`print', `graph refresh', ...)
+string timing_kind(const string& cmd);
+
+// The kind of command being processed
+void set_timing_kind(const string& kind);
+const string& timing_kind();
+
+// Account USECS to PHASE of the current command kind
+void timing_record(TimingPhase phase, double usecs);
+
+// Account USECS to PHASE of KIND
+void timing_record(const string& kind, TimingPhase phase, double usecs);
+
+// Human-readable summary of all histograms
+string timing_report();
+
+// All histograms as JSON object
+string timing_json();
+
+// Clear all histograms
+void timing_reset();
+
+
+// Time spent in a scope
+class TimingScope {
+    TimingPhase phase;
+    double start;
+
+    TimingScope(const TimingScope&);
+    TimingScope& operator = (const TimingScope&);
+
+public:
+    TimingScope(TimingPhase p)
+	: phase(p), start(timing() ? timing_now() : 0.0)
+    {}
+
+    ~TimingScope()
+    {
+	if (start > 0.0)
+	    timing_record(phase, timing_now() - start);
+    }
+};
+
+
+// Timestamps of a single debugger command
+class CommandTimer {
+    string kind;
+    double written;		// Command was written
+    double first_byte;		// First byte of reply was read
+    double prompt;		// Prompt was seen
+
+public:
+    CommandTimer()
+	: kind(), written(0.0), first_byte(0.0), prompt(0.0)
+    {}
+
+    // Command of kind KIND is being written
+    void start(const string& kind);
+
+    // Reply data has been read
+    void input_seen();
+
+    // Prompt has been seen
+    void prompt_seen();
+
+    // Reply has been processed; record all phases
+    void done();
+};
+
+#endif // _DDD_timing_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
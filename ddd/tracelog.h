@@ -0,0 +1,75 @@
+// $Id$ -*- C++ -*-
+// Asynchronous writer for the DDD log
+
+// Copyright (c) 2025  Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_tracelog_h
+#define _DDD_tracelog_h
+
+#include "base/strclass.h"
+#include "base/bool.h"
+#include <iostream>
+#include <sys/time.h>
+
+// Log file formats
+enum TraceLogFormat {
+    TRACE_TEXT,			// Human-readable (as read by the log player)
+    TRACE_BINARY		// Compact; convert using `--decode-log'
+};
+
+// Number of rotated log files kept (FILE.1 ... FILE.N)
+const int TRACE_LOG_GENERATIONS = 3;
+
+// Open the log.  All output is queued and written to FILE by a
+// background thread; if FILE is empty, standard error is used.  If
+// MAX_SIZE is positive, FILE is rotated as soon as it grows beyond
+// MAX_SIZE bytes.  Return a stream to write log messages to.
+std::ostream *tracelog_open(const string& file, TraceLogFormat format,
+			    long max_size = 0);
+
+// True if the log has been opened
+bool tracelog_active();
+
+// Log LENGTH bytes of debugger communication at DATA, prefixed by
+// PREFIX (`<- ', `-> ', or `<= ').  Quoting and time stamping are
+// done by the writer.
+void tracelog_chunk(const char *prefix, const char *data, int length);
+
+// Wait until everything queued so far has been written
+void tracelog_sync();
+
+// Write everything and stop the writer.  Later output is written
+// synchronously.
+void tracelog_close();
+
+// The text-format representation of a chunk logged at TV
+string tracelog_text(const char *prefix, const char *data, int length,
+		     const struct timeval& tv);
+
+// Convert the binary log FILE to text format on OS.  Return false
+// (and issue a message on standard error) if FILE cannot be read.
+bool tracelog_decode(const string& file, std::ostream& os);
+
+#endif // _DDD_tracelog_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -0,0 +1,63 @@
+// $Id$ -*- C++ -*-
+// Read numeric arrays in binary representation
+
+// Copyright (c) 2025  Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_value_bin_h
+#define _DDD_value_bin_h
+
+#include "base/strclass.h"
+#include "base/bool.h"
+
+#include <vector>
+
+// Element kinds of numeric arrays
+enum BinaryElementKind {
+    BINARY_SIGNED,		// Signed integer
+    BINARY_UNSIGNED,		// Unsigned integer
+    BINARY_FLOAT		// IEEE floating-point number
+};
+
+// Determine the kind of the element type TYPE, as issued by `whatis';
+// return false if TYPE is no integer or floating-point type whose
+// values GDB prints as plain numbers.
+bool binary_element_kind(const string& type, BinaryElementKind& kind);
+
+// Format the COUNT elements of SIZE bytes at DATA exactly as GDB does
+// and append them to VALUES.  BIG_ENDIAN tells the byte order of
+// DATA.  Return false if SIZE is not supported for KIND.
+bool format_binary_array(const char *data, int count, int size,
+			 BinaryElementKind kind, bool big_endian,
+			 std::vector<string>& values);
+
+// Fetch the values of the first (up to) MAX_COUNT elements of the C
+// array EXPR in binary form; store them in VALUES and the
+// number of elements of EXPR in LENGTH.  Return false if EXPR is not
+// a one-dimensional array of numbers or if it cannot be read that
+// way; in this case, the textual output of GDB must be used.
+bool read_binary_array(const string& expr, int max_count,
+		       std::vector<string>& values, int& length);
+
+#endif // _DDD_value_bin_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -61,6 +61,13 @@ void read_array_end(string& value);
 // Read `<repeats N times>'; return N (1 if no repeat)
 int read_repeats(string& value);
 
+// Read the `...' GDB issues after the last array element printed if
+// there are more (`set print elements'); return false iff not found
+bool read_array_truncated(string& value);
+
+// Skip all remaining array elements up to the end of the array
+void skip_array_elements(string& value);
+
 // Read struct or class; return false iff error
 bool read_struct_begin (string& value, string& addr);
 bool read_struct_next (string& value);